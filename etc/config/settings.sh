@@ -240,7 +240,7 @@ fi
 case "${foamCompiler}" in
 OpenFOAM | ThirdParty)
     case "$WM_COMPILER" in
-    Gcc | Gcc++0x | Gcc48 | Gcc48++0x)
+    Gcc | Gcc++0x | Gcc48 | Gcc48++0x | GccOmp)
         gcc_version=gcc-4.8.2
         gmp_version=gmp-5.1.2
         mpfr_version=mpfr-3.1.2